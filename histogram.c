@@ -6,11 +6,15 @@
 #include <assert.h>
 #include <math.h>
 #include <limits.h>
+#include <stddef.h>
 
 #include "histogram.h"
 #include "logger.h"
 #include "runtime.h"
 
+// hst_save only persists the histogram itself, not the replication bookkeeping after the bins
+#define HST_IMAGE_SIZE offsetof(histogram_t, deltas)
+
 retcode_t hst_init(runtime_t *rt, histogram_t *hst, int base, int exponent) {
     memcpy(hst->header, "HST", 4);
     hst->rt = rt;
@@ -19,6 +23,8 @@ retcode_t hst_init(runtime_t *rt, histogram_t *hst, int base, int exponent) {
     hst->exponent = exponent;
     hst->base = base;
     memset(hst->bins, 0, sizeof(hst->bins));
+    memset(hst->deltas, 0, sizeof(hst->deltas));
+    memset(hst->dirty, 0, sizeof(hst->dirty));
     return EXIT_SUCCESS;
 }
 
@@ -29,75 +35,117 @@ retcode_t hst_destroy(histogram_t *hst) {
     hst->exponent = -1;
     hst->base = -1;
     memset(hst->bins, 0, sizeof(hst->bins));
+    memset(hst->deltas, 0, sizeof(hst->deltas));
+    memset(hst->dirty, 0, sizeof(hst->dirty));
     return EXIT_SUCCESS;
 }
 
-retcode_t hst_compact(histogram_t *hst) {
-    bin_t new_bins[BIN_COUNT];
-    int new_bin_count;
+bool hst_is_dirty(histogram_t *hst, int idx) {
+    return (hst->dirty[idx / 8] & (1 << (idx % 8))) != 0;
+}
 
-    RT_ASSERT(hst->rt, hst->bin_count == BIN_COUNT, "Error: Histogram is not full");
-    if (hst->rt->has_error) {
-        return EXIT_FAILURE;
+void hst_set_dirty(histogram_t *hst, int idx, bool dirty) {
+    if (dirty) {
+        hst->dirty[idx / 8] |= (1 << (idx % 8));
+    } else {
+        hst->dirty[idx / 8] &= ~(1 << (idx % 8));
     }
+}
 
-    for (int i = 0; i < hst->bin_count; i++) {
-        RT_ASSERT(hst->rt, hst->bins[i].count > 0, "Error: found an uncompacted bin with an empty count at index %d", i);
-        if (hst->rt->has_error) {
-            return EXIT_FAILURE;
-        }
-    }
+void hst_clear_dirty(histogram_t *hst) {
+    memset(hst->deltas, 0, sizeof(hst->deltas));
+    memset(hst->dirty, 0, sizeof(hst->dirty));
+}
+
+void hst_increment_bin(histogram_t *hst, int idx, int count) {
+    hst->bins[idx].count += count;
+    hst->deltas[idx] += count;
+    hst->count += count;
+    hst_set_dirty(hst, idx, true);
+}
+
+retcode_t hst_rescale(histogram_t *hst) {
+    bin_t new_bins[BIN_COUNT];
+    int new_deltas[BIN_COUNT];
+    int new_bin_count = 0;
 
-recompact:
-    new_bin_count = 0;
     memset(new_bins, 0, sizeof(new_bins));
-    // compact the old bins into the new bins
-    for (int i = 0; i < BIN_COUNT; i++) {
-        
+    memset(new_deltas, 0, sizeof(new_deltas));
+    // compact the old bins into the new bins, carrying the pending deltas along
+    for (int i = 0; i < hst->bin_count; i++) {
+
         double new_alpha = floor(hst->bins[i].alpha / hst->base);
-        
+
         if (new_bin_count == 0) {
             new_bins[new_bin_count].alpha = new_alpha;
             new_bins[new_bin_count].count = hst->bins[i].count;
+            new_deltas[new_bin_count] = hst->deltas[i];
             new_bin_count++;
             continue;
-        } 
+        }
 
         if (new_bins[new_bin_count - 1].alpha == new_alpha) {
             new_bins[new_bin_count - 1].count += hst->bins[i].count;
+            new_deltas[new_bin_count - 1] += hst->deltas[i];
             continue;
         }
         // allocate a new bin in the new bins array for the current bin
         new_bins[new_bin_count].alpha = new_alpha;
         new_bins[new_bin_count].count = hst->bins[i].count;
+        new_deltas[new_bin_count] = hst->deltas[i];
         new_bin_count++;
     }
 
-    // clear old bins
+    // clear old bins and rebuild the dirty bitmap for the new bin positions
+    memset(hst->dirty, 0, sizeof(hst->dirty));
     for (int i = 0; i < BIN_COUNT; i++) {
         if (i < new_bin_count) {
             hst->bins[i].alpha = new_bins[i].alpha;
             hst->bins[i].count = new_bins[i].count;
+            hst->deltas[i] = new_deltas[i];
+            hst_set_dirty(hst, i, new_deltas[i] > 0);
         } else {
             hst->bins[i].alpha = 0;
             hst->bins[i].count = 0;
+            hst->deltas[i] = 0;
         }
     }
 
     hst->bin_count = new_bin_count;
     hst->exponent++;
-    if (hst->bin_count == BIN_COUNT) {
-        goto recompact;
+    return EXIT_SUCCESS;
+}
+
+retcode_t hst_compact(histogram_t *hst) {
+    retcode_t rc;
+
+    RT_ASSERT(hst->rt, hst->bin_count == BIN_COUNT, "Error: Histogram is not full");
+    if (hst->rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    for (int i = 0; i < hst->bin_count; i++) {
+        RT_ASSERT(hst->rt, hst->bins[i].count > 0, "Error: found an uncompacted bin with an empty count at index %d", i);
+        if (hst->rt->has_error) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    // a single pass might not merge any bins if the values are too spread
+    while (hst->bin_count == BIN_COUNT) {
+        rc = hst_rescale(hst);
+        RT_ASSERT(hst->rt, rc == EXIT_SUCCESS, "Error: Failed to rescale histogram");
+        if (hst->rt->has_error) {
+            return EXIT_FAILURE;
+        } 
     }
     return EXIT_SUCCESS;
 }
 
-retcode_t hst_find_insertion_point(histogram_t *hst, double value, int *idx, bool *match) {
+retcode_t hst_find_alpha(histogram_t *hst, int alpha, int *idx, bool *match) {
     int i = 0;
     *match = false;
     
-    int alpha = floor(value / pow(hst->base, hst->exponent));
-    
     for (i = 0; i < hst->bin_count; i++) {
         RT_ASSERT(hst->rt, hst->bins[i].count > 0, "Error: Bin count is zero");
         if (hst->rt->has_error) {
@@ -123,61 +171,103 @@ retcode_t hst_find_insertion_point(histogram_t *hst, double value, int *idx, boo
     return EXIT_SUCCESS;
 }
 
-retcode_t hst_update(histogram_t *hst, double value) {
+retcode_t hst_find_insertion_point(histogram_t *hst, double value, int *idx, bool *match) {
+    int alpha = floor(value / pow(hst->base, hst->exponent));
+    return hst_find_alpha(hst, alpha, idx, match);
+}
+
+retcode_t hst_add_to_bin(histogram_t *hst, int alpha, int exponent, int count) {
     retcode_t rc;
 
+    RT_ASSERT(hst->rt, exponent <= hst->exponent, "Error: Alpha exponent %d is finer than histogram exponent %d", exponent, hst->exponent);
+    if (hst->rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    // bring the alpha to the exponent of the histogram the same way compaction does
+    while (exponent < hst->exponent && alpha != 0) {
+        alpha = floor(alpha / hst->base);
+        exponent++;
+    }
+    exponent = hst->exponent;
+
     int idx;
     bool match;
-    rc = hst_find_insertion_point(hst, value, &idx, &match);
+    rc = hst_find_alpha(hst, alpha, &idx, &match);
     RT_ASSERT(hst->rt, rc == EXIT_SUCCESS, "Error: Failed to find insertion point");
     if (hst->rt->has_error) {
         return EXIT_FAILURE;
     }
 
+    // if the value is already in the histogram, increment the count
     if (match) {
-        hst->bins[idx].count++;
-        hst->count++;
+        hst_increment_bin(hst, idx, count);
         return EXIT_SUCCESS;
-    } 
-    
-    // compact the histogram if it is full
+    }
+
+    // compact the histogram if it is full and try again with the rescaled alpha
     if (hst->bin_count == BIN_COUNT) {
         rc = hst_compact(hst);
         RT_ASSERT(hst->rt, rc == EXIT_SUCCESS, "Error: Failed to compact histogram");
         if (hst->rt->has_error) {
             return EXIT_FAILURE;
         }
-        RT_ASSERT(hst->rt, hst->bin_count < BIN_COUNT, "Error: Histogram is still full after compaction");
-        if (hst->rt->has_error) {
-            return EXIT_FAILURE;
-        }
+        return hst_add_to_bin(hst, alpha, exponent, count);
+    }
+
+    // shift the elements to make room for the new element
+    for (int i = hst->bin_count; i > idx; i--) {
+        hst->bins[i].alpha = hst->bins[i - 1].alpha;
+        hst->bins[i].count = hst->bins[i - 1].count;
+        hst->deltas[i] = hst->deltas[i - 1];
+        hst_set_dirty(hst, i, hst_is_dirty(hst, i - 1));
+    }
+    hst->bins[idx].alpha = alpha;
+    hst->bins[idx].count = 0;
+    hst->deltas[idx] = 0;
+    hst->bin_count++;
+    hst_increment_bin(hst, idx, count);
+    
+    RT_ASSERT(hst->rt, hst->bin_count <= BIN_COUNT, "Error: Bin count is greater than default bin count");
+    if (hst->rt->has_error) {
+        return EXIT_FAILURE;
     }
 
-    // having compacted the histogram, find the insertion point again
+    return EXIT_SUCCESS;
+}
+
+retcode_t hst_update(histogram_t *hst, double value) {
+    retcode_t rc;
+
+    int idx;
+    bool match;
     rc = hst_find_insertion_point(hst, value, &idx, &match);
     RT_ASSERT(hst->rt, rc == EXIT_SUCCESS, "Error: Failed to find insertion point");
     if (hst->rt->has_error) {
         return EXIT_FAILURE;
     }
-    
-    // if the value is already in the histogram, increment the count
+
     if (match) {
-        hst->bins[idx].count++;
-        hst->count++;
+        hst_increment_bin(hst, idx, 1);
         return EXIT_SUCCESS;
     } 
-
-    // shift the elements to make room for the new element
-    for (int i = hst->bin_count; i >= idx; i--) {
-        hst->bins[i].alpha = hst->bins[i - 1].alpha;
-        hst->bins[i].count = hst->bins[i - 1].count;
-    }
-    hst->bins[idx].alpha = floor(value / pow(hst->base, hst->exponent));
-    hst->bins[idx].count = 1;
-    hst->count++;
-    hst->bin_count++;
     
-    RT_ASSERT(hst->rt, hst->bin_count <= BIN_COUNT, "Error: Bin count is greater than default bin count");
+    // compact the histogram if it is full
+    if (hst->bin_count == BIN_COUNT) {
+        rc = hst_compact(hst);
+        RT_ASSERT(hst->rt, rc == EXIT_SUCCESS, "Error: Failed to compact histogram");
+        if (hst->rt->has_error) {
+            return EXIT_FAILURE;
+        }
+        RT_ASSERT(hst->rt, hst->bin_count < BIN_COUNT, "Error: Histogram is still full after compaction");
+        if (hst->rt->has_error) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    // having compacted the histogram, the alpha must be computed again
+    rc = hst_add_to_bin(hst, floor(value / pow(hst->base, hst->exponent)), hst->exponent, 1);
+    RT_ASSERT(hst->rt, rc == EXIT_SUCCESS, "Error: Failed to add value to histogram");
     if (hst->rt->has_error) {
         return EXIT_FAILURE;
     }
@@ -250,7 +340,120 @@ retcode_t hst_display_percentiles(histogram_t *hst, FILE *fp, double precision)
     return EXIT_SUCCESS;
 }
 
+unsigned int hst_zigzag_encode(int value) {
+    return ((unsigned int)value << 1) ^ (unsigned int)(value >> (sizeof(int) * CHAR_BIT - 1));
+}
+
+int hst_zigzag_decode(unsigned int value) {
+    return (int)((value >> 1) ^ (~(value & 1) + 1));
+}
+
+retcode_t hst_write_varint(runtime_t *rt, FILE *fp, unsigned int value) {
+    unsigned char buf[(sizeof(unsigned int) * CHAR_BIT + 6) / 7];
+    int len = 0;
+    do {
+        buf[len] = value & 0x7F;
+        value >>= 7;
+        if (value != 0) {
+            buf[len] |= 0x80;
+        }
+        len++;
+    } while (value != 0);
+    int written = fwrite(buf, 1, len, fp);
+    RT_ASSERT(rt, written == len, "Error: Failed to write varint to file");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+retcode_t hst_read_varint(runtime_t *rt, FILE *fp, unsigned int *value) {
+    *value = 0;
+    for (unsigned int shift = 0; shift < sizeof(unsigned int) * CHAR_BIT; shift += 7) {
+        int c = fgetc(fp);
+        RT_ASSERT(rt, c != EOF, "Error: Failed to read varint from file");
+        if (rt->has_error) {
+            return EXIT_FAILURE;
+        }
+        *value |= (unsigned int)(c & 0x7F) << shift;
+        if ((c & 0x80) == 0) {
+            return EXIT_SUCCESS;
+        }
+    }
+    RT_PUSH_ERROR(rt, "Error: Varint is too long");
+    return EXIT_FAILURE;
+}
+
+/*
+ * Writes the number of dirty bins followed by, for each of them, the zigzagged distance
+ * to the previous alpha and the count increment since the last delta, all as varints.
+ */
+retcode_t hst_write_deltas(histogram_t *hst, FILE *fp) {
+    retcode_t rc;
+    runtime_t *rt = hst->rt;
+
+    int changed = 0;
+    for (int i = 0; i < hst->bin_count; i++) {
+        if (hst->dirty[i / 8] == 0) {
+            i += 7 - i % 8;
+            continue;
+        }
+        if (hst_is_dirty(hst, i)) {
+            changed++;
+        }
+    }
+    rc = hst_write_varint(rt, fp, changed);
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    int prev_alpha = 0;
+    for (int i = 0; i < hst->bin_count; i++) {
+        if (hst->dirty[i / 8] == 0) {
+            i += 7 - i % 8;
+            continue;
+        }
+        if (!hst_is_dirty(hst, i)) {
+            continue;
+        }
+        int alpha_delta = (int)((unsigned int)hst->bins[i].alpha - (unsigned int)prev_alpha);
+        rc = hst_write_varint(rt, fp, hst_zigzag_encode(alpha_delta));
+        if (rc != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
+        rc = hst_write_varint(rt, fp, hst->deltas[i]);
+        if (rc != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
+        prev_alpha = hst->bins[i].alpha;
+    }
+    return EXIT_SUCCESS;
+}
+
+retcode_t hst_read_delta_entry(runtime_t *rt, FILE *fp, int *alpha, int *count) {
+    retcode_t rc;
+    unsigned int alpha_delta;
+    unsigned int increment;
+
+    rc = hst_read_varint(rt, fp, &alpha_delta);
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    rc = hst_read_varint(rt, fp, &increment);
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    RT_ASSERT(rt, increment > 0 && increment <= INT_MAX, "Error: Invalid delta count %u", increment);
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    *alpha = (int)((unsigned int)*alpha + (unsigned int)hst_zigzag_decode(alpha_delta));
+    *count = increment;
+    return EXIT_SUCCESS;
+}
+
 retcode_t hst_save(histogram_t *hst, FILE *fp) {
+    retcode_t rc;
     runtime_t *rt = hst->rt;
 
     RT_ASSERT(hst->rt, fp != NULL, "Error: file is not open");
@@ -258,26 +461,205 @@ retcode_t hst_save(histogram_t *hst, FILE *fp) {
         return EXIT_FAILURE;
     }
     hst->rt = NULL;
-    int written = fwrite(hst, sizeof(histogram_t), 1, fp);
+    int written = fwrite(hst, HST_IMAGE_SIZE, 1, fp);
+    hst->rt = rt;
     RT_ASSERT(rt, written == 1, "Error: Failed to write histogram to file");
     if (rt->has_error) {
         return EXIT_FAILURE;
     }
-    hst->rt = rt;
+
+    // the pending deltas follow the image so that the next delta can pick up where this one left
+    written = fwrite("HSR", 4, 1, fp);
+    RT_ASSERT(rt, written == 1, "Error: Failed to write replication header to file");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    rc = hst_write_deltas(hst, fp);
+    RT_ASSERT(rt, rc == EXIT_SUCCESS, "Error: Failed to write pending deltas to file");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
     return EXIT_SUCCESS;
 }
 
 retcode_t hst_load(runtime_t *rt, histogram_t *hst, FILE *fp) {
+    retcode_t rc;
+    char header[4];
+
     RT_ASSERT(rt, fp != NULL, "Error: file is not open");
-    if (hst->rt->has_error) {
+    if (rt->has_error) {
         return EXIT_FAILURE;
     }
-    int read = fread(hst, sizeof(histogram_t), 1, fp);
+    int read = fread(hst, HST_IMAGE_SIZE, 1, fp);
     RT_ASSERT(rt, read == 1, "Error: Failed to read histogram from file");
     if (rt->has_error) {
         return EXIT_FAILURE;
     }
     hst->rt = rt;
+    RT_ASSERT(rt, memcmp(hst->header, "HST", 4) == 0, "Error: File does not contain a histogram");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    hst_clear_dirty(hst);
+
+    // images saved before replication existed end here
+    int c = fgetc(fp);
+    if (c == EOF) {
+        return EXIT_SUCCESS;
+    }
+    ungetc(c, fp);
+
+    read = fread(header, sizeof(header), 1, fp);
+    RT_ASSERT(rt, read == 1, "Error: Failed to read replication header from file");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    RT_ASSERT(rt, memcmp(header, "HSR", 4) == 0, "Error: Invalid replication header");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    unsigned int changed;
+    rc = hst_read_varint(rt, fp, &changed);
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    RT_ASSERT(rt, changed <= (unsigned int)hst->bin_count, "Error: Too many pending deltas: %u", changed);
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    int alpha = 0;
+    for (unsigned int i = 0; i < changed; i++) {
+        int count;
+        rc = hst_read_delta_entry(rt, fp, &alpha, &count);
+        if (rc != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
+        int idx;
+        bool match;
+        rc = hst_find_alpha(hst, alpha, &idx, &match);
+        RT_ASSERT(rt, rc == EXIT_SUCCESS && match, "Error: Pending delta refers to missing bin %d", alpha);
+        if (rt->has_error) {
+            return EXIT_FAILURE;
+        }
+        hst->deltas[idx] = count;
+        hst_set_dirty(hst, idx, true);
+    }
+    return EXIT_SUCCESS;
+}
+
+/*
+ * A delta starts with the "HSD" header followed by the zigzagged base and exponent of the
+ * histogram and the deltas written by hst_write_deltas. Deltas carry count increments only,
+ * so deltas from several histograms can be applied to the same aggregate.
+ */
+retcode_t hst_save_delta(histogram_t *hst, FILE *fp) {
+    retcode_t rc;
+    runtime_t *rt = hst->rt;
+
+    RT_ASSERT(rt, fp != NULL, "Error: file is not open");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    int written = fwrite("HSD", 4, 1, fp);
+    RT_ASSERT(rt, written == 1, "Error: Failed to write delta header to file");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    rc = hst_write_varint(rt, fp, hst_zigzag_encode(hst->base));
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    rc = hst_write_varint(rt, fp, hst_zigzag_encode(hst->exponent));
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    rc = hst_write_deltas(hst, fp);
+    RT_ASSERT(rt, rc == EXIT_SUCCESS, "Error: Failed to write deltas to file");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    hst_clear_dirty(hst);
+    return EXIT_SUCCESS;
+}
+
+retcode_t hst_apply_delta(histogram_t *hst, FILE *fp) {
+    retcode_t rc;
+    runtime_t *rt = hst->rt;
+    char header[4];
+
+    RT_ASSERT(rt, fp != NULL, "Error: file is not open");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    int read = fread(header, sizeof(header), 1, fp);
+    RT_ASSERT(rt, read == 1, "Error: Failed to read delta header from file");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    RT_ASSERT(rt, memcmp(header, "HSD", 4) == 0, "Error: Invalid delta header");
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    unsigned int base;
+    rc = hst_read_varint(rt, fp, &base);
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    RT_ASSERT(rt, hst_zigzag_decode(base) == hst->base, "Error: Delta base %d does not match histogram base %d", hst_zigzag_decode(base), hst->base);
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    unsigned int encoded_exponent;
+    rc = hst_read_varint(rt, fp, &encoded_exponent);
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    int exponent = hst_zigzag_decode(encoded_exponent);
+
+    // a delta taken after the sender compacted forces the histogram to the same exponent
+    while (hst->exponent < exponent) {
+        // rescaling further would not change the bins
+        if (hst->bin_count == 0 || (hst->bin_count == 1 && hst->bins[0].alpha == 0)) {
+            hst->exponent = exponent;
+            break;
+        }
+        rc = hst_rescale(hst);
+        RT_ASSERT(rt, rc == EXIT_SUCCESS, "Error: Failed to rescale histogram");
+        if (rt->has_error) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    unsigned int changed;
+    rc = hst_read_varint(rt, fp, &changed);
+    if (rc != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    RT_ASSERT(rt, changed <= BIN_COUNT, "Error: Delta has too many bins: %u", changed);
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    int alpha = 0;
+    for (unsigned int i = 0; i < changed; i++) {
+        int count;
+        rc = hst_read_delta_entry(rt, fp, &alpha, &count);
+        if (rc != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
+        rc = hst_add_to_bin(hst, alpha, exponent, count);
+        RT_ASSERT(rt, rc == EXIT_SUCCESS, "Error: Failed to apply delta bin %d", alpha);
+        if (rt->has_error) {
+            return EXIT_FAILURE;
+        }
+    }
     return EXIT_SUCCESS;
 }
 
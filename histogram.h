@@ -4,6 +4,8 @@
 #include <stdbool.h>
 #include "runtime.h"
 
+#define DIRTY_BYTES ((BIN_COUNT + 7) / 8)
+
 typedef struct {
     int alpha;
     int count;
@@ -17,6 +19,9 @@ typedef struct {
     int count;
     int bin_count;
     bin_t bins[BIN_COUNT];
+    // replication bookkeeping, kept out of the hst_save image
+    int deltas[BIN_COUNT]; // count increments per bin since the last delta
+    unsigned char dirty[DIRTY_BYTES]; // bins whose delta is non zero
 } histogram_t;
 
 typedef struct {
@@ -35,6 +40,8 @@ extern retcode_t hst_display(histogram_t *hst, FILE *fp);
 extern retcode_t hst_display_percentiles(histogram_t *hst, FILE *fp, double precision);
 extern retcode_t hst_save(histogram_t *hst, FILE *fp);
 extern retcode_t hst_load(runtime_t *rt, histogram_t *hst, FILE *fp);
+extern retcode_t hst_save_delta(histogram_t *hst, FILE *fp);
+extern retcode_t hst_apply_delta(histogram_t *hst, FILE *fp);
 extern retcode_t hst_get_percentiles(histogram_t *hst, percentiles_t *pcts);
 extern retcode_t hst_get_percentile(histogram_t *hst, percentiles_t *pcts, double pct, double *value);
 #endif // HISTOGRAM_H
\ No newline at end of file
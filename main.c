@@ -13,6 +13,8 @@
 
 typedef struct {
     char *filename;
+    char *delta_filename;
+    char *apply_filename;
     int base;
     int exponent;
     bool percentiles;
@@ -30,6 +32,8 @@ void usage(char *progname) {
     fprintf(stderr, "  -e EXPONENT Set the exponent of the histogram. Defaults to %d\n", DEFAULT_EXPONENT);
     fprintf(stderr, "  -p          Show percentiles. Use default precision of %0.02lf\n", DEFAULT_PERCENTILES_PRECISION);
     fprintf(stderr, "  -P          Set the precision of the percentiles. Implies -p.\n");
+    fprintf(stderr, "  -d DELTA    Append a delta of the changes since the last delta to DELTA\n");
+    fprintf(stderr, "  -a DELTA    Apply the deltas found in DELTA before reading stdin\n");
     fprintf(stderr, "  -q          Quiet mode\n");
     fprintf(stderr, "  -h          Print this message and exit\n");
 }
@@ -37,6 +41,8 @@ void usage(char *progname) {
 retcode_t parse_options(runtime_t *rt, int argc, char *argv[], options_t *options) {
     int opt;
     options->filename = NULL;
+    options->delta_filename = NULL;
+    options->apply_filename = NULL;
     options->base = DEFAULT_BASE;
     options->exponent = DEFAULT_EXPONENT;
     options->percentiles = false;
@@ -44,7 +50,7 @@ retcode_t parse_options(runtime_t *rt, int argc, char *argv[], options_t *option
     options->quiet = false;
     options->help = false;
 
-    while ((opt = getopt(argc, argv, "b:e:pP:qh")) != -1) {
+    while ((opt = getopt(argc, argv, "b:e:pP:d:a:qh")) != -1) {
         switch (opt) {
             case 'b':
                 options->base = atoi(optarg);
@@ -67,6 +73,14 @@ retcode_t parse_options(runtime_t *rt, int argc, char *argv[], options_t *option
                 options->percentiles_precision = atof(optarg);
                 break;
 
+            case 'd':
+                options->delta_filename = optarg;
+                break;
+
+            case 'a':
+                options->apply_filename = optarg;
+                break;
+
             case 'q':
                 options->quiet = true;
                 break;
@@ -85,6 +99,33 @@ retcode_t parse_options(runtime_t *rt, int argc, char *argv[], options_t *option
     return EXIT_SUCCESS;
 }
 
+retcode_t append_file(runtime_t *rt, FILE *src, char *filename) {
+    char buf[BUFSIZ];
+    size_t read;
+
+    FILE *fp = fopen(filename, "ab");
+    RT_ASSERT(rt, fp != NULL, "Error: Failed to open file %s", filename);
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+
+    rewind(src);
+    while ((read = fread(buf, 1, sizeof(buf), src)) > 0) {
+        size_t written = fwrite(buf, 1, read, fp);
+        RT_ASSERT(rt, written == read, "Error: Failed to write file %s", filename);
+        if (rt->has_error) {
+            fclose(fp);
+            return EXIT_FAILURE;
+        }
+    }
+    RT_ASSERT(rt, !ferror(src), "Error: Failed to read temporary file");
+    RT_ASSERT(rt, fclose(fp) == 0, "Error: Failed to write file %s", filename);
+    if (rt->has_error) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
 int main(int argc, char *argv[]) {
     retcode_t rc;
     runtime_t rt;
@@ -123,6 +164,24 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    if (options.apply_filename != NULL) {
+        FILE *fp = fopen(options.apply_filename, "rb");
+        if (fp == NULL) {
+            runtime_push_error(&rt, __FILE__, __func__, __LINE__, "Error: Failed to open file %s", options.apply_filename);
+            runtime_print_error(&rt);
+            return EXIT_FAILURE;
+        }
+        // the file may hold several deltas appended one after the other
+        while (ungetc(fgetc(fp), fp) != EOF) {
+            rc = hst_apply_delta(&hst, fp);
+            if (rc != EXIT_SUCCESS) {
+                runtime_print_error(&rt);
+                return EXIT_FAILURE;
+            }
+        }
+        fclose(fp);
+    }
+
     double value;
     while (true) {
         
@@ -162,20 +221,68 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    // taking the delta clears the pending deltas, so it is staged until FILE is saved
+    FILE *delta_fp = NULL;
+    if (options.delta_filename != NULL) {
+        delta_fp = tmpfile();
+        if (delta_fp == NULL) {
+            runtime_push_error(&rt, __FILE__, __func__, __LINE__, "Error: Failed to create temporary file");
+            runtime_print_error(&rt);
+            return EXIT_FAILURE;
+        }
+
+        rc = hst_save_delta(&hst, delta_fp);
+        if (rc != EXIT_SUCCESS) {
+            runtime_print_error(&rt);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // FILE is only replaced once the delta is published, so a failure never leaves
+    // published increments pending in FILE to be sent again
+    char tmp_filename[FILENAME_MAX];
     if (options.filename != NULL) {
-        FILE *fp = fopen(options.filename, "wb");
+        snprintf(tmp_filename, sizeof(tmp_filename), "%s.tmp", options.filename);
+        FILE *fp = fopen(tmp_filename, "wb");
         if (fp == NULL) {
-            runtime_push_error(&rt, __FILE__, __func__, __LINE__, "Error: Failed to open file %s", options.filename);
+            runtime_push_error(&rt, __FILE__, __func__, __LINE__, "Error: Failed to open file %s", tmp_filename);
             runtime_print_error(&rt);
             return EXIT_FAILURE;
         }
         
         rc = hst_save(&hst, fp);
         if (rc != EXIT_SUCCESS) {
+            runtime_print_error(&rt);
+            fclose(fp);
+            remove(tmp_filename);
+            return EXIT_FAILURE;
+        }
+        if (fclose(fp) != 0) {
+            runtime_push_error(&rt, __FILE__, __func__, __LINE__, "Error: Failed to write file %s", tmp_filename);
+            runtime_print_error(&rt);
+            remove(tmp_filename);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (delta_fp != NULL) {
+        rc = append_file(&rt, delta_fp, options.delta_filename);
+        fclose(delta_fp);
+        if (rc != EXIT_SUCCESS) {
+            runtime_print_error(&rt);
+            if (options.filename != NULL) {
+                remove(tmp_filename);
+            }
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.filename != NULL) {
+        if (rename(tmp_filename, options.filename) != 0) {
+            runtime_push_error(&rt, __FILE__, __func__, __LINE__, "Error: Failed to replace file %s", options.filename);
             runtime_print_error(&rt);
             return EXIT_FAILURE;
         }
-        fclose(fp);
     }
 
     return EXIT_SUCCESS;